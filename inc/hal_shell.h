@@ -106,6 +106,14 @@ void hal_shell_run_command(const char *str);
  */
 void nas_ndi_port_map_dump(npu_id_t npu_id,npu_port_t port_id);
 
+/**
+ * This function call prints out the MAC move dampening counters and the MAC entries
+ * currently dampened as flapping. The output will be captured into the HShell.
+ *
+ * @param npu_id the identifier of the npu.
+ */
+void nas_ndi_mac_move_dampening_dump(npu_id_t npu_id);
+
 /**
  * @}
  */
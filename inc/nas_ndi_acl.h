@@ -250,9 +250,54 @@ t_std_error ndi_acl_table_set_priority (npu_id_t npu_id,
                                         ndi_obj_id_t ndi_tbl_id,
                                         ndi_acl_priority_t tbl_priority);
 
+/**
+ * @brief Create a shadow ACL table to replace an existing ACL table
+ *
+ * The shadow table is created in NPU but does not process traffic until it
+ * is swapped in with ndi_acl_table_swap. Entries are added to it with the
+ * regular entry create APIs using the shadow table ID.
+ *
+ * @param npu_id - NPU ID in which to create
+ * @param ndi_active_tbl_id - NDI Table ID of the table to be replaced
+ * @param ndi_tbl_p - Attributes for the shadow table, stage must match
+ *                    the table to be replaced
+ * @param[out] ndi_shadow_tbl_id - Shadow Table ID generated by NDI.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_table_shadow_create (npu_id_t npu_id,
+                                         ndi_obj_id_t ndi_active_tbl_id,
+                                         const ndi_acl_table_t* ndi_tbl_p,
+                                         ndi_obj_id_t* ndi_shadow_tbl_id_p);
+
+/**
+ * @brief Atomically replace an ACL table with its shadow table
+ *
+ * The shadow table takes over the priority and bindings of the active
+ * table in a single NPU operation, then the old table is deleted along
+ * with its entries. ACL counters and ranges used by the old entries are
+ * not deleted. Utilization thresholds scoped to the active table keep their
+ * IDs and move to the shadow table, which is then checked against them. A
+ * software classifier enabled on the active table is enabled on the shadow
+ * table. If either cannot be moved the swap fails.
+ *
+ * @param npu_id - NPU ID in which to modify
+ * @param ndi_active_tbl_id - NDI Table ID of the table to be replaced
+ * @param ndi_shadow_tbl_id - NDI Table ID of the shadow table
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned. On failure the active table is left in place.
+ */
+t_std_error ndi_acl_table_swap (npu_id_t npu_id,
+                                ndi_obj_id_t ndi_active_tbl_id,
+                                ndi_obj_id_t ndi_shadow_tbl_id);
+
 /**
  * @brief Create a new ACL Entry in NPU
  *
+ * Rejected on a position managed table, see ndi_acl_entry_position_t.
+ *
  * @param npu_id - NPU ID in which to create
  * @param t_create - Attributes for the ACL Entry being created
  * @param[out] ndi_entry_id - Entry ID generated by NDI.
@@ -276,9 +321,130 @@ t_std_error ndi_acl_entry_create (npu_id_t npu_id,
 t_std_error ndi_acl_entry_delete (npu_id_t npu_id,
                                   ndi_obj_id_t ndi_entry_id);
 
+/**
+ * @brief Opaque ACL Entry pre-translated into NPU attributes.
+ * Built by ndi_acl_entry_compile so that the filter and action lists are
+ * validated and translated once, and installed with ndi_acl_entry_bulk_create.
+ */
+typedef struct _ndi_acl_compiled_entry ndi_acl_compiled_entry_t;
+
+/**
+ * @brief Validate and translate an ACL Entry for later installation
+ *
+ * @param npu_id - NPU ID for which to translate
+ * @param ndi_entry_p - Attributes for the ACL Entry, the filter and action
+ *                      lists are copied and need not be kept by the caller
+ * @param[out] compiled_entry_p - Compiled entry, to be freed with
+ *                                ndi_acl_compiled_entry_free.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_entry_compile (npu_id_t npu_id,
+                                   const ndi_acl_entry_t* ndi_entry_p,
+                                   ndi_acl_compiled_entry_t** compiled_entry_p);
+
+/**
+ * @brief Free a compiled ACL Entry, installed entries are not affected
+ *
+ * @param compiled_entry - Compiled entry to be freed.
+ */
+void ndi_acl_compiled_entry_free (ndi_acl_compiled_entry_t* compiled_entry);
+
+/**
+ * @brief Create a list of compiled ACL Entries in one ACL table in NPU
+ *
+ * Rejected on a position managed table, see ndi_acl_entry_position_t.
+ *
+ * @param npu_id - NPU ID in which to create
+ * @param ndi_tbl_id - NDI Table ID in which to create, must match the
+ *                     table_id the entries were compiled with
+ * @param compiled_entry_list - List of compiled entries
+ * @param entry_count - Number of entries in compiled_entry_list
+ * @param mode - Bulk error handling mode, see ndi_bulk_op_error_mode_t for
+ *               the status_list contract
+ * @param[out] ndi_entry_id_list - Entry ID generated by NDI per entry.
+ * @param[out] status_list - Per-entry status, same size as compiled_entry_list.
+ *
+ * @return STD_ERR_OK if all the entries are created successfully otherwise
+ *  the error code of the first failed entry is returned.
+ */
+t_std_error ndi_acl_entry_bulk_create (npu_id_t npu_id,
+                                       ndi_obj_id_t ndi_tbl_id,
+                                       ndi_acl_compiled_entry_t* const* compiled_entry_list,
+                                       size_t entry_count,
+                                       ndi_bulk_op_error_mode_t mode,
+                                       ndi_obj_id_t* ndi_entry_id_list,
+                                       t_std_error* status_list);
+
+/**
+ * @brief ACL Entry list compression result
+ */
+typedef struct _ndi_acl_compress_stats {
+    size_t      in_entry_count;   /* Entries passed for compression */
+    size_t      out_entry_count;  /* Entries after compression */
+    size_t      range_count;      /* ACL ranges referenced by the merged entries */
+} ndi_acl_compress_stats_t;
+
+/**
+ * @brief Merge ACL entries of one table that have identical actions
+ *
+ * Entries with identical action lists whose filters differ in a single
+ * field are merged into fewer entries by prefix/mask aggregation or by
+ * L4 port ranges. Entries are only merged when no entry between them in
+ * priority order with different actions can match the same packets, so
+ * the result classifies every packet the same way as the input.
+ *
+ * The L4 port ranges used by the merged entries are created with
+ * ndi_acl_range_create and returned in range_list. The caller owns one
+ * reference to each and releases it with ndi_acl_range_delete once the
+ * entries using the range are deleted, the same as for any other range.
+ *
+ * @param npu_id - NPU ID for which to compress
+ * @param in_entry_list - Entries to be compressed, all in the same table
+ * @param in_entry_count - Number of entries in in_entry_list
+ * @param[out] out_entry_list - Compressed entries allocated by NDI, to be
+ *                              freed with ndi_acl_entry_list_free.
+ * @param[out] out_entry_count - Number of entries in out_entry_list
+ * @param[out] entry_map - Index in out_entry_list of each input entry,
+ *                         same size as in_entry_list, may be NULL.
+ * @param[out] range_list - IDs of the ACL ranges created for the merged
+ *                          entries, the list is allocated by NDI and freed
+ *                          with ndi_acl_entry_list_free.
+ * @param[out] stats - Compression result, may be NULL.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_entry_list_compress (npu_id_t npu_id,
+                                         const ndi_acl_entry_t* in_entry_list,
+                                         size_t in_entry_count,
+                                         ndi_acl_entry_t** out_entry_list,
+                                         size_t* out_entry_count,
+                                         size_t* entry_map,
+                                         ndi_obj_id_list_t* range_list,
+                                         ndi_acl_compress_stats_t* stats);
+
+/**
+ * @brief Free the memory of the lists returned by ndi_acl_entry_list_compress.
+ * The ACL ranges in range_list are not released, the lists can be freed as
+ * soon as the entries are created.
+ *
+ * @param npu_id - NPU ID for which the list was compressed
+ * @param entry_list - Entry list to be freed.
+ * @param entry_count - Number of entries in entry_list
+ * @param range_list - Range ID list to be freed, may be NULL.
+ */
+void ndi_acl_entry_list_free (npu_id_t npu_id,
+                              ndi_acl_entry_t* entry_list,
+                              size_t entry_count,
+                              ndi_obj_id_list_t* range_list);
+
 /**
  * @brief Modify the Priority of an existing ACL entry
  *
+ * Rejected on a position managed table, see ndi_acl_entry_position_t.
+ *
  * @param npu_id - NPU ID in which to modify
  * @param ndi_entry_id - NDI Entry ID of entry to be modified.
  * @param entry_priority - New value for Entry priority.
@@ -290,6 +456,111 @@ t_std_error ndi_acl_entry_set_priority (npu_id_t npu_id,
                                         ndi_obj_id_t ndi_entry_id,
                                         ndi_acl_priority_t entry_priority);
 
+/**
+ * @brief Position of an ACL Entry relative to the other entries in its table.
+ * An entry placed before another entry is matched ahead of it.
+ *
+ * A table is either position managed or priority managed. An empty table
+ * becomes position managed with its first ndi_acl_entry_create_at, and
+ * priority managed with its first entry created with ndi_acl_entry_create
+ * or ndi_acl_entry_bulk_create. Calls of the other kind are rejected until
+ * the table is empty again: ndi_acl_entry_create, ndi_acl_entry_bulk_create
+ * and ndi_acl_entry_set_priority on a position managed table, and
+ * ndi_acl_entry_create_at and ndi_acl_entry_move on a priority managed one.
+ * A shadow table starts empty and picks its own kind the same way.
+ */
+typedef enum {
+    NDI_ACL_ENTRY_POS_FIRST,    /* Ahead of all entries in the table */
+    NDI_ACL_ENTRY_POS_LAST,     /* After all entries in the table */
+    NDI_ACL_ENTRY_POS_BEFORE,   /* Immediately ahead of the reference entry */
+    NDI_ACL_ENTRY_POS_AFTER,    /* Immediately after the reference entry */
+} ndi_acl_entry_position_t;
+
+/**
+ * @brief ACL table priority allocator statistics
+ */
+typedef struct _ndi_acl_priority_alloc_stats {
+    uint64_t                insert_count;  /* Entries placed by position */
+    uint64_t                move_count;    /* Existing entries re-prioritized */
+    uint64_t                rebalance_count; /* Priority space rebalances */
+} ndi_acl_priority_alloc_stats_t;
+
+/**
+ * @brief Create a new ACL Entry in NPU at a position relative to other entries
+ *
+ * NDI picks the entry priority within the table so that existing entries
+ * rarely need to be re-prioritized; priority in ndi_entry_p is ignored.
+ * The new priorities of the re-prioritized entries can be read with
+ * ndi_acl_entry_get_priority.
+ *
+ * @param npu_id - NPU ID in which to create
+ * @param ndi_entry_p - Attributes for the ACL Entry being created
+ * @param position - Position of the new entry
+ * @param ref_entry_id - Reference entry for NDI_ACL_ENTRY_POS_BEFORE/AFTER
+ * @param[out] ndi_entry_id - Entry ID generated by NDI.
+ * @param[in,out] moved_list - May be NULL. count is the capacity of list on
+ *  input and the number of existing entries re-prioritized on output, list
+ *  is filled with their IDs. If more entries need to be re-prioritized than
+ *  list can hold nothing is changed, count is set to the required size and
+ *  an error is returned.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_entry_create_at (npu_id_t npu_id,
+                                     const ndi_acl_entry_t* ndi_entry_p,
+                                     ndi_acl_entry_position_t position,
+                                     ndi_obj_id_t ref_entry_id,
+                                     ndi_obj_id_t* ndi_entry_id_p,
+                                     ndi_obj_id_list_t* moved_list_p);
+
+/**
+ * @brief Move an existing ACL entry to a position relative to other entries
+ *
+ * @param npu_id - NPU ID in which to modify
+ * @param ndi_entry_id - NDI Entry ID of entry to be moved.
+ * @param position - New position of the entry
+ * @param ref_entry_id - Reference entry for NDI_ACL_ENTRY_POS_BEFORE/AFTER
+ * @param[in,out] moved_list - IDs of the other entries re-prioritized, may
+ *  be NULL. Same as in ndi_acl_entry_create_at.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_entry_move (npu_id_t npu_id,
+                                ndi_obj_id_t ndi_entry_id,
+                                ndi_acl_entry_position_t position,
+                                ndi_obj_id_t ref_entry_id,
+                                ndi_obj_id_list_t* moved_list_p);
+
+/**
+ * @brief Get the priority NDI allocated for an ACL entry
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param ndi_entry_id - NDI Entry ID of entry to be retrieved.
+ * @param [out] entry_priority - Current Entry priority.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_entry_get_priority (npu_id_t npu_id,
+                                        ndi_obj_id_t ndi_entry_id,
+                                        ndi_acl_priority_t* entry_priority_p);
+
+/**
+ * @brief Get the priority allocator statistics of an ACL table
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param ndi_tbl_id - NDI Table ID of table to be retrieved.
+ * @param [out] stats - Priority allocator statistics.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_table_get_priority_alloc_stats (npu_id_t npu_id,
+                                                    ndi_obj_id_t ndi_tbl_id,
+                                                    ndi_acl_priority_alloc_stats_t* stats_p);
+
 /**
  * @brief Add/Modify individual Filter field of an existing ACL entry
  *
@@ -485,6 +756,31 @@ t_std_error ndi_acl_counter_get_count (npu_id_t npu_id,
                                        uint64_t* byte_count_p,
                                        uint64_t* pkt_count_p);
 
+/**
+ * @brief Get byte and packet count for a list of counters
+ *
+ * Every counter in the list is read irrespective of earlier failures, as in
+ * NDI_BULK_OP_CONTINUE_ON_ERROR mode. See ndi_bulk_op_error_mode_t for the status_list contract.
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param ndi_counter_id_list - NDI Counter IDs of counters to be obtained.
+ * @param counter_count - Number of counters in ndi_counter_id_list.
+ * @param mode - NAS_NDI_STATS_MODE_READ or NAS_NDI_STATS_MODE_READ_AND_CLEAR.
+ * @param [out] byte_count_list - result in bytes per counter, may be NULL.
+ * @param [out] pkt_count_list - result in packets per counter, may be NULL.
+ * @param [out] status_list - per counter status, same size as ndi_counter_id_list.
+ *
+ * @return STD_ERR_OK if all the counters are read successfully otherwise
+ *  the error code of the first failed counter is returned.
+ */
+t_std_error ndi_acl_counter_bulk_get_count (npu_id_t npu_id,
+                                            const ndi_obj_id_t* ndi_counter_id_list,
+                                            size_t counter_count,
+                                            ndi_stats_mode_t mode,
+                                            uint64_t* byte_count_list,
+                                            uint64_t* pkt_count_list,
+                                            t_std_error* status_list);
+
 typedef enum {
     NDI_ACL_RANGE_L4_SRC_PORT,
     NDI_ACL_RANGE_L4_DST_PORT,
@@ -503,6 +799,10 @@ typedef struct _ndi_acl_range {
 /**
  * @brief Create a new ACL range in NPU
  *
+ * Ranges are shared by value. If a range with the same type, min and max
+ * already exists in the NPU its Range ID is returned and its reference
+ * count is incremented instead of creating a new NPU range object.
+ *
  * @param npu_id - NPU ID in which to create
  * @param acl_range_p - Attributes for the ACL Range being created
  * @param[out] ndi_range_id - Range ID generated by NDI.
@@ -515,6 +815,9 @@ t_std_error ndi_acl_range_create(npu_id_t npu_id, const ndi_acl_range_t *acl_ran
 /**
  * @brief Delete an existing ACL Range from NPU
  *
+ * Decrements the reference count of the range, the NPU range object is
+ * deleted when the last reference is released.
+ *
  * @param npu_id - NPU ID in which to delete
  * @param ndi_range_id - NDI Range ID of ACL Range to be deleted.
  *
@@ -523,6 +826,39 @@ t_std_error ndi_acl_range_create(npu_id_t npu_id, const ndi_acl_range_t *acl_ran
  */
 t_std_error ndi_acl_range_delete(npu_id_t npu_id, ndi_obj_id_t ndi_range_id);
 
+/**
+ * @brief Get the number of references held on an existing ACL Range
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param ndi_range_id - NDI Range ID of ACL Range to be retrieved.
+ * @param[out] ref_count - Number of ndi_acl_range_create calls not yet
+ *                         released by ndi_acl_range_delete.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_range_get_ref_count(npu_id_t npu_id, ndi_obj_id_t ndi_range_id,
+                                        uint32_t *ref_count_p);
+
+/**
+ * @brief ACL Range sharing statistics
+ */
+typedef struct _ndi_acl_range_stats {
+    size_t      range_obj_count;  /* NPU range objects in use */
+    size_t      range_ref_count;  /* References held across all range objects */
+} ndi_acl_range_stats_t;
+
+/**
+ * @brief Get the ACL Range sharing statistics
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param[out] range_stats - ACL Range sharing statistics.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_range_get_stats(npu_id_t npu_id, ndi_acl_range_stats_t *range_stats_p);
+
 
 /**
  * @brief Retrieve existing ACL Slice usage information
@@ -552,6 +888,222 @@ t_std_error ndi_acl_get_slice_attribute (npu_id_t npu_id, ndi_obj_id_t slice_id,
 t_std_error ndi_acl_get_acl_table_attribute (npu_id_t npu_id, ndi_obj_id_t table_id,
                                              ndi_acl_table_attr_t *table_attr);
 
+/**
+ * @brief ACL utilization of one pipeline of an ACL Slice or ACL Table.
+ * Answered from a model NDI keeps up to date on entry create/delete,
+ * without reading from the NPU.
+ */
+typedef struct _ndi_acl_utilization {
+    ndi_obj_id_t            obj_id;          /* ACL Slice or ACL Table ID */
+    uint32_t                pipeline_index;
+    size_t                  used_count;
+    size_t                  avail_count;
+} ndi_acl_utilization_t;
+
+/**
+ * @brief Retrieve cached ACL Slice utilization
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param slice_id - NDI ID of ACL Slice to be retrieved.
+ * @param[out] util - ACL Slice utilization.
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_get_slice_utilization (npu_id_t npu_id, ndi_obj_id_t slice_id,
+                                           ndi_acl_utilization_t *util);
+
+/**
+ * @brief Retrieve cached ACL Table utilization, one entry per pipeline
+ *
+ * @param npu_id - NPU ID in which to retrieve
+ * @param table_id - NDI ID of ACL Table to be retrieved.
+ * @param[out] util_list - ACL Table utilization per pipeline.
+ * @param[in/out] util_count - number of entries allocated in util_list, on
+ *                             return the number of pipelines filled
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_get_table_utilization (npu_id_t npu_id, ndi_obj_id_t table_id,
+                                           ndi_acl_utilization_t *util_list,
+                                           size_t *util_count);
+
+/**
+ * @brief Objects monitored by an ACL utilization threshold
+ */
+typedef enum {
+    NDI_ACL_UTIL_SCOPE_ALL_SLICES,  /* Every ACL Slice of the NPU */
+    NDI_ACL_UTIL_SCOPE_SLICE,       /* One ACL Slice */
+    NDI_ACL_UTIL_SCOPE_TABLE,       /* One ACL Table */
+} ndi_acl_utilization_scope_t;
+
+/**
+ * @brief ACL utilization threshold
+ *
+ * Each pipeline of a monitored object is tracked separately. A pipeline
+ * notifies once when its used percentage reaches threshold_pct and is not
+ * notified again until it falls to clear_pct or below, which notifies the
+ * clear and re-arms the threshold.
+ */
+typedef struct _ndi_acl_utilization_threshold {
+    npu_id_t                    npu_id;
+    ndi_acl_utilization_scope_t scope;
+    ndi_obj_id_t                obj_id;        /* ACL Slice or Table ID, unused
+                                                  for NDI_ACL_UTIL_SCOPE_ALL_SLICES */
+    uint32_t                    threshold_pct; /* 1 to 100 */
+    uint32_t                    clear_pct;     /* Less than threshold_pct */
+} ndi_acl_utilization_threshold_t;
+
+/**
+ * @brief   ACL utilization threshold crossing callback type.
+ * @param   npu_id NPU ID
+ * @param   threshold_id threshold returned by ndi_acl_utilization_threshold_register
+ * @param   util utilization of the pipeline that crossed the threshold
+ * @param   above true when utilization reached threshold_pct, false when it
+ *          fell back to clear_pct
+ * @return  None
+ */
+typedef void (*ndi_acl_utilization_notification_fn) (npu_id_t npu_id,
+                                                     ndi_obj_id_t threshold_id,
+                                                     const ndi_acl_utilization_t *util,
+                                                     bool above);
+
+/**
+ * @brief Register for ACL utilization threshold crossing notifications
+ *
+ * Every call adds an independent threshold, the same callback may be
+ * registered for several thresholds and objects. A threshold_pct of 0 or
+ * above 100, or a clear_pct not below threshold_pct is rejected. Pipelines
+ * already at or above threshold_pct are notified right after registration.
+ * A threshold on an ACL Slice or Table is removed along with the object,
+ * a threshold on a table replaced by ndi_acl_table_swap moves to the new one.
+ *
+ * @param threshold - objects and levels to monitor
+ * @param reg_fn - callback invoked on each crossing of the threshold
+ * @param[out] threshold_id - ID of the threshold generated by NDI
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_utilization_threshold_register (const ndi_acl_utilization_threshold_t *threshold,
+                                                    ndi_acl_utilization_notification_fn reg_fn,
+                                                    ndi_obj_id_t *threshold_id_p);
+
+/**
+ * @brief Unregister an ACL utilization threshold, no callback is invoked for
+ * it once this returns
+ *
+ * @param threshold_id - ID of the threshold to be removed
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_utilization_threshold_unregister (ndi_obj_id_t threshold_id);
+
+/**
+ * @brief Packet header fields used for software ACL classification
+ *
+ * A VLAN tag is present only when its valid flag is set, so priority tagged
+ * frames are given with VLAN ID 0 and the valid flag set. Entries with a
+ * filter on a field the key does not carry, such as a packet length range or
+ * metadata, cannot be classified and make the lookup fail with
+ * NDI_ACL_CLASSIFY_UNSUPPORTED_FILTER rather than be skipped.
+ */
+typedef struct _ndi_acl_packet_key {
+    ndi_port_t              in_port;
+    bool                    out_port_valid;   /* Egress stage tables only */
+    ndi_port_t              out_port;
+    hal_mac_addr_t          src_mac;
+    hal_mac_addr_t          dst_mac;
+    bool                    outer_vlan_valid; /* Packet has an outer tag */
+    uint16_t                outer_vlan_id;
+    uint8_t                 outer_vlan_pri;   /* 802.1p PCP */
+    bool                    inner_vlan_valid; /* Packet has an inner tag */
+    uint16_t                inner_vlan_id;
+    uint8_t                 inner_vlan_pri;   /* 802.1p PCP */
+    uint16_t                ether_type;
+    BASE_ACL_MATCH_IP_TYPE_t ip_type;
+    BASE_ACL_MATCH_IP_FRAG_t ip_frag;
+    hal_ip_addr_t           src_ip;
+    hal_ip_addr_t           dst_ip;
+    uint32_t                ipv6_flow_label;
+    uint8_t                 ip_protocol;
+    uint8_t                 dscp;
+    uint8_t                 ecn;
+    uint8_t                 ttl;
+    uint8_t                 tcp_flags;
+    uint8_t                 icmp_type;
+    uint8_t                 icmp_code;
+    ndi_acl_l4_port_t       l4_src_port;
+    ndi_acl_l4_port_t       l4_dst_port;
+    size_t                  udf_count;
+    ndi_byte_list_t        *udf_list;         /* UDF data indexed by udf_seq_no */
+} ndi_acl_packet_key_t;
+
+/* No entry of the table matches the packet */
+#define NDI_ACL_CLASSIFY_NO_MATCH               STD_ERR(NPU, FAIL, 0xb1)
+/* An entry of the table filters on a field the classifier cannot evaluate */
+#define NDI_ACL_CLASSIFY_UNSUPPORTED_FILTER     STD_ERR(NPU, FAIL, 0xb2)
+
+/**
+ * @brief Enable/Disable the software classifier of an ACL table
+ *
+ * When enabled NDI keeps a software copy of the table entries, built from
+ * the same filters passed to the entry create/set APIs, that can be looked
+ * up with ndi_acl_classify.
+ *
+ * @param npu_id - NPU ID in which to modify
+ * @param ndi_tbl_id - NDI Table ID of table to be mirrored.
+ * @param enable - Bool - Enable (True) Disable (False).
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_acl_table_classifier_enable (npu_id_t npu_id,
+                                             ndi_obj_id_t ndi_tbl_id,
+                                             bool enable);
+
+/**
+ * @brief Find the ACL entry of a table that a packet would match
+ *
+ * @param npu_id - NPU ID in which to look up
+ * @param ndi_tbl_id - NDI Table ID of table with the classifier enabled.
+ * @param key - Packet header fields.
+ * @param [out] ndi_entry_id - Highest priority matching Entry ID.
+ *
+ * @return STD_ERR_OK if a matching entry is found, NDI_ACL_CLASSIFY_NO_MATCH
+ *  if no entry matches, NDI_ACL_CLASSIFY_UNSUPPORTED_FILTER if an entry
+ *  that could match filters on a field missing from the key, otherwise a
+ *  different error code is returned.
+ */
+t_std_error ndi_acl_classify (npu_id_t npu_id,
+                              ndi_obj_id_t ndi_tbl_id,
+                              const ndi_acl_packet_key_t* key,
+                              ndi_obj_id_t* ndi_entry_id_p);
+
+/**
+ * @brief Find the ACL entry of a table that a raw packet would match
+ *
+ * The key is parsed from the frame, UDF data is extracted with the UDF
+ * groups of the table. Egress ports and UDF groups that cannot be resolved
+ * from the frame are reported as NDI_ACL_CLASSIFY_UNSUPPORTED_FILTER.
+ *
+ * @param npu_id - NPU ID in which to look up
+ * @param ndi_tbl_id - NDI Table ID of table with the classifier enabled.
+ * @param pkt - Ethernet frame.
+ * @param len - Length of the frame.
+ * @param in_port - Port the frame was received on.
+ * @param [out] ndi_entry_id - Highest priority matching Entry ID.
+ *
+ * @return Same as ndi_acl_classify
+ */
+t_std_error ndi_acl_classify_packet (npu_id_t npu_id,
+                                     ndi_obj_id_t ndi_tbl_id,
+                                     const uint8_t* pkt, uint32_t len,
+                                     const ndi_port_t* in_port,
+                                     ndi_obj_id_t* ndi_entry_id_p);
+
 /**
  * \}
  */
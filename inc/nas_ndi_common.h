@@ -241,6 +241,29 @@ typedef enum {
     NAS_NDI_STATS_MODE_SYNC_AND_READ,
 } ndi_stats_mode_t;
 
+/**
+ * @brief Error handling mode for NDI bulk operations.
+ *
+ * Bulk APIs take a list of entries and fill a parallel per-entry status list.
+ * On return every element of the status list is written, callers need not
+ * initialize it:
+ *  - STD_ERR_OK for an entry that was applied successfully
+ *  - the error code of an entry that was attempted and failed
+ *  - NDI_BULK_OP_NOT_EXECUTED for an entry that was not attempted because
+ *    an earlier entry failed in NDI_BULK_OP_STOP_ON_ERROR mode
+ * The API returns STD_ERR_OK if every entry was applied successfully,
+ * otherwise the error code of the first failed entry in list order.
+ */
+typedef enum {
+    /* Stop at the first failed entry, entries after it are not programmed */
+    NDI_BULK_OP_STOP_ON_ERROR,
+    /* Attempt every entry in the list irrespective of earlier failures */
+    NDI_BULK_OP_CONTINUE_ON_ERROR,
+} ndi_bulk_op_error_mode_t;
+
+/* Per-entry bulk status of an entry that was not attempted */
+#define NDI_BULK_OP_NOT_EXECUTED    STD_ERR(NPU, FAIL, 0xb0)
+
 /** callback functions */
 
 /**
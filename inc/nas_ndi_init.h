@@ -23,6 +23,7 @@
 #define __NAS_NDI_INIT_H
 
 #include "std_error_codes.h"
+#include <stdint.h>
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -40,6 +41,43 @@ extern "C" {
  */
 t_std_error nas_ndi_init(void);
 
+/**
+ * Soft NPU configuration. The soft NPU is an in-memory implementation of the
+ * NDI API that is used in place of the SAI backed one to run functional tests
+ * and benchmarks without an ASIC. A table size of 0 selects the default.
+ */
+typedef struct nas_ndi_soft_npu_cfg_s {
+    uint32_t npu_count;             /* Number of NPUs */
+    uint32_t port_count;            /* Ports per NPU */
+    uint32_t vlan_table_size;       /* Max VLANs */
+    uint32_t lag_table_size;        /* Max LAGs */
+    uint32_t stg_table_size;        /* Max STG instances */
+    uint32_t mac_table_size;        /* Max MAC entries */
+    uint32_t route_table_size;      /* Max routes */
+    uint32_t neighbor_table_size;   /* Max neighbors */
+    uint32_t nh_group_table_size;   /* Max next hop groups */
+    uint32_t acl_entry_table_size;  /* Max ACL entries */
+    uint32_t mcast_table_size;      /* Max multicast entries */
+    uint32_t latency_usec;          /* Latency injected in each API call */
+    uint32_t latency_jitter_usec;   /* Random latency added on top of latency_usec */
+} nas_ndi_soft_npu_cfg_t;
+
+/**
+ * This function initializes NDI with the soft NPU backend instead of the SAI library.
+ * It is used instead of nas_ndi_init.
+ * @param cfg soft NPU configuration
+ * @return  std_error
+ */
+t_std_error nas_ndi_soft_npu_init(const nas_ndi_soft_npu_cfg_t *cfg);
+
+/**
+ * This function changes the latency injected by the soft NPU in each API call.
+ * @param latency_usec latency in microseconds
+ * @param latency_jitter_usec random latency added on top of latency_usec
+ * @return  std_error
+ */
+t_std_error nas_ndi_soft_npu_set_latency(uint32_t latency_usec, uint32_t latency_jitter_usec);
+
 /**
  *  \}
  */
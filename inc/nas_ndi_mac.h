@@ -112,6 +112,7 @@ typedef enum {
     NDI_MAC_EVENT_AGED,             /** MAC entry aged */
     NDI_MAC_EVENT_FLUSHED,          /** MAC entry removed */
     NDI_MAC_EVENT_MOVED,            /** MAC entry moved */
+    NDI_MAC_EVENT_FLAPPING,         /** MAC entry moves suppressed by move dampening */
     NDI_MAC_EVENT_INVALID
 } ndi_mac_event_type_t;
 
@@ -172,6 +173,126 @@ t_std_error ndi_update_mac_entry(ndi_mac_entry_t * entry, ndi_mac_attr_flags att
 t_std_error ndi_delete_mac_entry(ndi_mac_entry_t *entry, ndi_mac_delete_type_t delete_type, bool type_set);
 
 
+/**
+ * @brief Add a list of MAC address entries into the MAC Table
+ * @param entry_list - MAC address entries to be configured, mandatory attributes
+ *                     are the same as ndi_create_mac_entry
+ * @param entry_count - Number of entries in entry_list
+ * @param mode - Bulk error handling mode, see ndi_bulk_op_error_mode_t for the
+ *              status_list contract
+ * @param status_list - Per-entry status(OUT), same size as entry_list
+ *
+ * @return - STD_ERR_OK if all the entries are configured successfully otherwise the
+ *           error code of the first failed entry is returned.
+ */
+t_std_error ndi_bulk_create_mac_entry(ndi_mac_entry_t *entry_list, size_t entry_count,
+                                      ndi_bulk_op_error_mode_t mode, t_std_error *status_list);
+
+
+/**
+ * @brief Update a list of existing MAC Address entries
+ * @param entry_list - MAC entries containing the key and new attributes, attr_flag of
+ *                     each entry indicates which attribute needs to be updated
+ * @param entry_count - Number of entries in entry_list
+ * @param mode - Bulk error handling mode, see ndi_bulk_op_error_mode_t for the
+ *              status_list contract
+ * @param status_list - Per-entry status(OUT), same size as entry_list
+ *
+ * @return - STD_ERR_OK if all the entries are updated successfully otherwise the
+ *           error code of the first failed entry is returned.
+ */
+t_std_error ndi_bulk_update_mac_entry(ndi_mac_entry_t *entry_list, size_t entry_count,
+                                      ndi_bulk_op_error_mode_t mode, t_std_error *status_list);
+
+
+/**
+ * @brief Delete a list of single MAC entries, same as ndi_delete_mac_entry with
+ *        NDI_MAC_DEL_SINGLE_ENTRY for each entry
+ * @param entry_list - MAC entries to be deleted
+ * @param entry_count - Number of entries in entry_list
+ * @param mode - Bulk error handling mode, see ndi_bulk_op_error_mode_t for the
+ *              status_list contract
+ * @param status_list - Per-entry status(OUT), same size as entry_list
+ *
+ * @return - STD_ERR_OK if all the entries are deleted successfully otherwise the
+ *           error code of the first failed entry is returned.
+ */
+t_std_error ndi_bulk_delete_mac_entry(ndi_mac_entry_t *entry_list, size_t entry_count,
+                                      ndi_bulk_op_error_mode_t mode, t_std_error *status_list);
+
+
+/**
+ * @brief MAC flush filter match flags, flags can be combined and an entry is
+ *        flushed only when it matches all the set criteria. NDI_MAC_FLUSH_MATCH_PORT
+ *        and NDI_MAC_FLUSH_MATCH_LAG are mutually exclusive, a filter with both set
+ *        is rejected as an invalid parameter.
+ */
+typedef enum {
+    NDI_MAC_FLUSH_MATCH_PORT        = (1 << 0),  /** Match port_info */
+    NDI_MAC_FLUSH_MATCH_LAG         = (1 << 1),  /** Match ndi_lag_id */
+    NDI_MAC_FLUSH_MATCH_VLAN        = (1 << 2),  /** Match any VLAN in vlan_list */
+    NDI_MAC_FLUSH_MATCH_BRIDGE      = (1 << 3),  /** Match bridge_id */
+    NDI_MAC_FLUSH_MATCH_ENDPOINT_IP = (1 << 4),  /** Match endpoint_ip */
+} ndi_mac_flush_match_flags_t;
+
+
+/**
+ * @brief Static/dynamic MAC entry selection
+ */
+typedef enum {
+    NDI_MAC_STATIC_TYPE_ALL = 0,   /** Match static and dynamic entries */
+    NDI_MAC_STATIC_TYPE_STATIC,    /** Match static entries only */
+    NDI_MAC_STATIC_TYPE_DYNAMIC,   /** Match dynamic entries only */
+} ndi_mac_static_type_t;
+
+
+/**
+ * @brief MAC flush filter, also used to select entries of the shadow FDB. A filter
+ *        with no match_flags set matches every entry of the NPU of the selected
+ *        static_type.
+ */
+typedef struct ndi_mac_flush_filter_s {
+    npu_id_t                    npu_id;          /** NPU ID */
+    uint32_t                    match_flags;     /** ndi_mac_flush_match_flags_t bitmap */
+    ndi_mac_static_type_t       static_type;     /** Static/dynamic selection */
+    ndi_port_t                  port_info;       /** NDI port (npu/local port) */
+    uint64_t                    ndi_lag_id;      /** LAG ID */
+    size_t                      vlan_count;      /** Number of VLANs in vlan_list */
+    const hal_vlan_id_t        *vlan_list;       /** VLAN IDs */
+    uint64_t                    bridge_id;       /** 1D Bridge ID */
+    hal_ip_addr_t               endpoint_ip;     /** Remote end-point IP */
+} ndi_mac_flush_filter_t;
+
+
+/**
+ * @brief   MAC flush result callback function type, may be invoked multiple times
+ *          for one flush
+ * @param   context context passed to ndi_mac_flush
+ * @param   entry_list list of flushed MAC entries
+ * @param   entry_count number of entries in entry_list
+ * @return  None
+ */
+typedef void (*ndi_mac_flush_result_fn) (void *context, const ndi_mac_entry_t *entry_list,
+                                         size_t entry_count);
+
+
+/**
+ * @brief Flush the MAC entries that match a filter. The flush is done with a single
+ *        NPU operation when the NPU supports the filter combination. Flushed entries
+ *        are removed from the shadow FDB and published as NDI_MAC_EVENT_FLUSHED
+ *        events to the registered event callback and every event ring like any other
+ *        MAC event, so other consumers see the flush. result_fn additionally reports
+ *        them to the caller before ndi_mac_flush returns.
+ * @param filter - MAC flush filter
+ * @param result_fn - Callback to report the flushed entries, NULL if not required
+ * @param context - Passed as is to result_fn
+ * @param flushed_count - Number of flushed entries(OUT), may be NULL
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_flush(const ndi_mac_flush_filter_t *filter, ndi_mac_flush_result_fn result_fn,
+                          void *context, size_t *flushed_count);
+
+
 /**
  * @brief   MAC entry event notification callback function type
  * @param   npu_id NPU ID
@@ -190,6 +311,324 @@ typedef void (*ndi_mac_event_notification_fn) (npu_id_t npu_id, ndi_mac_event_ty
 t_std_error ndi_mac_event_notify_register(ndi_mac_event_notification_fn reg_fn);
 
 
+/**
+ * @brief MAC event record used for batched MAC event delivery
+ */
+typedef struct ndi_mac_event_record_s {
+    ndi_mac_event_type_t        mac_event;       /** Event type */
+    ndi_mac_entry_t             mac_entry;       /** MAC entry details */
+    bool                        is_lag_index;    /** MAC entry belongs to a LAG */
+} ndi_mac_event_record_t;
+
+
+/**
+ * @brief Batched MAC event delivery configuration
+ */
+typedef struct ndi_mac_event_batch_cfg_s {
+    size_t                      max_batch_size;  /** Max records per callback invocation */
+    uint32_t                    max_latency_ms;  /** Max time a record is held before delivery */
+} ndi_mac_event_batch_cfg_t;
+
+
+/**
+ * @brief   Batched MAC event notification callback function type
+ * @param   npu_id NPU ID
+ * @param   event_list list of MAC event records
+ * @param   event_count number of records in event_list
+ * @return  None
+ */
+typedef void (*ndi_mac_event_batch_notification_fn) (npu_id_t npu_id,
+                                                     const ndi_mac_event_record_t *event_list,
+                                                     size_t event_count);
+
+
+/**
+ * @brief This function is used to register the callback function for batched MAC event
+ *        notification with NDI. Events are delivered once max_batch_size records are
+ *        pending or the oldest pending record is max_latency_ms old, whichever is first.
+ *        When registered, it is used instead of the ndi_mac_event_notification_fn callback.
+ *        Event rings are fed independently of the callbacks, see ndi_mac_event_ring_t.
+ * @param reg_fn - Callback function for batched MAC event notification
+ * @param cfg - Batch size and latency configuration
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_event_batch_notify_register(ndi_mac_event_batch_notification_fn reg_fn,
+                                                const ndi_mac_event_batch_cfg_t *cfg);
+
+
+/**
+ * @brief Opaque handle of a MAC event ring
+ *
+ * A MAC event ring is a bounded ring buffer of ndi_mac_event_record_t that the
+ * NDI layer publishes MAC events into from the NPU notification thread without
+ * blocking. Events are dropped and counted when the ring is full.
+ *
+ * Rings do not replace the callbacks: every MAC event is delivered to the
+ * registered callback (the batch one if registered, else the per-entry one)
+ * and a copy of it is published into every ring that exists. A full ring
+ * drops only its own copy, other rings and the callbacks are not affected.
+ */
+typedef struct ndi_mac_event_ring_s ndi_mac_event_ring_t;
+
+
+/**
+ * @brief MAC event ring statistics
+ */
+typedef struct ndi_mac_event_ring_stats_s {
+    size_t                      ring_size;       /** Ring capacity in records */
+    size_t                      depth;           /** Records currently in the ring */
+    size_t                      high_water_mark; /** Max depth seen */
+    uint64_t                    enqueued;        /** Records published */
+    uint64_t                    dequeued;        /** Records consumed */
+    uint64_t                    dropped;         /** Records dropped on a full ring */
+} ndi_mac_event_ring_stats_t;
+
+
+/**
+ * @brief Create a MAC event ring and start publishing MAC events into it
+ * @param ring_size - Ring capacity in records, rounded up to a power of two
+ * @param ring - Created ring handle(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_event_ring_create(size_t ring_size, ndi_mac_event_ring_t **ring);
+
+
+/**
+ * @brief Stop publishing MAC events into a ring and delete it
+ * @param ring - Ring handle
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_event_ring_delete(ndi_mac_event_ring_t *ring);
+
+
+/**
+ * @brief Get a file descriptor that becomes readable when the ring is not empty,
+ *        so consumers can wait on it with poll/epoll. The descriptor is level
+ *        triggered: it stays readable as long as records remain in the ring, also
+ *        after a poll that did not consume all of them. It is never read directly.
+ * @param ring - Ring handle
+ * @param fd - File descriptor(OUT), owned by the ring
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_event_ring_get_fd(ndi_mac_event_ring_t *ring, int *fd);
+
+
+/**
+ * @brief Consume MAC event records from a ring without blocking. A ring supports a
+ *        single consumer at a time.
+ * @param ring - Ring handle
+ * @param event_list - Caller allocated list to copy the records into
+ * @param max_count - Number of records allocated in event_list
+ * @param count - Number of records copied(OUT), 0 if the ring is empty
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_event_ring_poll(ndi_mac_event_ring_t *ring, ndi_mac_event_record_t *event_list,
+                                   size_t max_count, size_t *count);
+
+
+/**
+ * @brief Retrieve the MAC event ring statistics
+ * @param ring - Ring handle
+ * @param stats - Ring statistics(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_event_ring_stats_get(ndi_mac_event_ring_t *ring, ndi_mac_event_ring_stats_t *stats);
+
+
+/**
+ * @brief MAC move dampening configuration
+ *
+ * When a MAC entry (MAC address and VLAN or 1D bridge) moves more than
+ * move_threshold times within interval_sec, a single NDI_MAC_EVENT_FLAPPING
+ * event is delivered and further NDI_MAC_EVENT_MOVED events of that entry are
+ * suppressed until it has not moved for hold_sec. On release a single
+ * NDI_MAC_EVENT_MOVED event carrying the current port_info/ndi_lag_id of the
+ * entry is delivered, so consumers pick up the port the entry settled on.
+ * The shadow FDB is updated from every move before dampening is applied.
+ */
+typedef struct ndi_mac_move_dampening_cfg_s {
+    bool                        enable;          /** Enable move dampening */
+    uint32_t                    move_threshold;  /** Moves allowed within interval_sec */
+    uint32_t                    interval_sec;    /** Move counting interval */
+    uint32_t                    hold_sec;        /** Quiet time before a flapping entry is released */
+} ndi_mac_move_dampening_cfg_t;
+
+
+/**
+ * @brief MAC move dampening statistics
+ */
+typedef struct ndi_mac_move_dampening_stats_s {
+    uint64_t                    moves_received;  /** Move events received from NPU */
+    uint64_t                    moves_forwarded; /** Move events delivered */
+    uint64_t                    moves_suppressed;/** Move events suppressed */
+    uint64_t                    flap_events;     /** Flapping events delivered */
+    uint32_t                    flapping_entries;/** Entries currently dampened */
+} ndi_mac_move_dampening_stats_t;
+
+
+/**
+ * @brief Configure MAC move dampening
+ * @param npu_id - NPU ID
+ * @param cfg - Move dampening configuration
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_move_dampening_config_set(npu_id_t npu_id, const ndi_mac_move_dampening_cfg_t *cfg);
+
+
+/**
+ * @brief Retrieve MAC move dampening configuration
+ * @param npu_id - NPU ID
+ * @param cfg - Move dampening configuration(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_move_dampening_config_get(npu_id_t npu_id, ndi_mac_move_dampening_cfg_t *cfg);
+
+
+/**
+ * @brief Retrieve MAC move dampening statistics
+ * @param npu_id - NPU ID
+ * @param stats - Move dampening statistics(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_move_dampening_stats_get(npu_id_t npu_id, ndi_mac_move_dampening_stats_t *stats);
+
+
+/**
+ * @brief Default number of entries the shadow FDB is sized for
+ *
+ * The NDI layer keeps a shadow copy of the MAC table, maintained from the MAC
+ * create/update/delete APIs and the learn/age/flush/move events, so that MAC
+ * entries can be looked up and filtered without reading from the NPU.
+ */
+#define NDI_MAC_FDB_CACHE_DEFAULT_SIZE  (512*1024)
+
+
+/**
+ * @brief Shadow FDB statistics
+ */
+typedef struct ndi_mac_fdb_cache_stats_s {
+    size_t                      entry_count;     /** Entries in the shadow FDB */
+    size_t                      capacity;        /** Entries the shadow FDB is sized for */
+    size_t                      memory_bytes;    /** Memory used by the shadow FDB */
+} ndi_mac_fdb_cache_stats_t;
+
+
+/**
+ * @brief   Shadow FDB walk callback function type
+ * @param   context context passed to ndi_mac_fdb_cache_walk
+ * @param   mac_entry MAC entry details
+ * @return  true to continue the walk, false to stop it
+ */
+typedef bool (*ndi_mac_fdb_cache_walk_fn) (void *context, const ndi_mac_entry_t *mac_entry);
+
+
+/**
+ * @brief Retrieve the MAC entry from the shadow FDB without reading from the NPU
+ * @param mac_entry - Same as ndi_get_mac_entry_attr
+ * @return STD_ERR_OK if the entry is found otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_fdb_cache_lookup(ndi_mac_entry_t *mac_entry);
+
+
+/**
+ * @brief Walk the shadow FDB entries that match a filter. The filter selects entries
+ *        the same way as ndi_mac_flush, so entries can be selected by port, LAG,
+ *        VLANs, bridge or endpoint IP alone or combined, and by static_type.
+ *        The callback must not add or delete MAC entries.
+ * @param filter - MAC entry filter
+ * @param walk_fn - Callback invoked for each matching entry
+ * @param context - Passed as is to walk_fn
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_fdb_cache_walk(const ndi_mac_flush_filter_t *filter,
+                                   ndi_mac_fdb_cache_walk_fn walk_fn, void *context);
+
+
+/**
+ * @brief Count the shadow FDB entries that match a filter
+ * @param filter - MAC entry filter, same as ndi_mac_fdb_cache_walk
+ * @param count - Number of matching entries(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_fdb_cache_get_count(const ndi_mac_flush_filter_t *filter, size_t *count);
+
+
+/**
+ * @brief Retrieve the shadow FDB statistics
+ * @param npu_id - NPU ID
+ * @param stats - Shadow FDB statistics(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_fdb_cache_stats_get(npu_id_t npu_id, ndi_mac_fdb_cache_stats_t *stats);
+
+
+/**
+ * @brief MAC aging mode
+ */
+typedef enum {
+    NDI_MAC_AGING_MODE_HW = 0,      /** Aging done by the NPU */
+    NDI_MAC_AGING_MODE_SW,          /** Aging done by NDI by sampling entry hit bits */
+} ndi_mac_aging_mode_t;
+
+
+/**
+ * @brief MAC aging configuration
+ *
+ * In NDI_MAC_AGING_MODE_SW the hardware ager is disabled and every tick_ms NDI
+ * samples and clears the hit bits of the next slice of dynamic entries, so the
+ * whole table is visited once per aging interval set by ndi_switch_mac_age_time_set.
+ * An entry not hit for a full aging interval is removed and reported as
+ * NDI_MAC_EVENT_AGED, batched when ndi_mac_event_batch_notify_register is used.
+ */
+typedef struct ndi_mac_aging_cfg_s {
+    ndi_mac_aging_mode_t        mode;                  /** Aging mode */
+    uint32_t                    tick_ms;               /** Sampling tick interval */
+    uint32_t                    max_entries_per_tick;  /** Max entries sampled per tick, bounds
+                                                           the CPU cost of a tick */
+} ndi_mac_aging_cfg_t;
+
+
+/**
+ * @brief Software MAC aging statistics
+ */
+typedef struct ndi_mac_aging_stats_s {
+    uint64_t                    ticks;                 /** Ticks run */
+    uint64_t                    entries_sampled;       /** Entries whose hit bit was sampled */
+    uint64_t                    entries_aged;          /** Entries aged out */
+    uint64_t                    overrun_ticks;         /** Ticks that hit max_entries_per_tick
+                                                           before completing their slice */
+    uint32_t                    last_tick_usec;        /** CPU time of the last tick */
+    uint32_t                    max_tick_usec;         /** Max CPU time of a tick */
+} ndi_mac_aging_stats_t;
+
+
+/**
+ * @brief Configure the MAC aging mode
+ * @param npu_id - NPU ID
+ * @param cfg - MAC aging configuration
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_aging_config_set(npu_id_t npu_id, const ndi_mac_aging_cfg_t *cfg);
+
+
+/**
+ * @brief Retrieve the MAC aging configuration
+ * @param npu_id - NPU ID
+ * @param cfg - MAC aging configuration(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_aging_config_get(npu_id_t npu_id, ndi_mac_aging_cfg_t *cfg);
+
+
+/**
+ * @brief Retrieve the software MAC aging statistics
+ * @param npu_id - NPU ID
+ * @param stats - Software MAC aging statistics(OUT)
+ * @return STD_ERR_OK if operation is successful otherwise a different error code is returned.
+ */
+t_std_error ndi_mac_aging_stats_get(npu_id_t npu_id, ndi_mac_aging_stats_t *stats);
+
+
 /**
  * @brief Retrieve the MAC entry
  * @param mac_entry - Caller to fill up the mandatory fields into this entry
@@ -165,6 +165,41 @@ t_std_error ndi_route_delete(ndi_route_t *route_entry);
  */
 t_std_error ndi_route_set_attribute (ndi_route_t *p_route_entry);
 
+/**
+ * @brief Add a list of routes (IPv4 or IPv6) into NPU Routing table
+ *
+ * Entries are batched into as few NPU bulk route calls as possible.
+ * See ndi_bulk_op_error_mode_t for the status_list contract.
+ *
+ * @param route_list - list of route entries
+ * @param route_count - number of entries in route_list
+ * @param mode - bulk error handling mode
+ * @param[out] status_list - per-entry status, same size as route_list
+ *
+ * @return STD_ERR_OK if all the entries are programmed successfully otherwise
+ *  the error code of the first failed entry is returned.
+ */
+t_std_error ndi_route_bulk_add(ndi_route_t *route_list, size_t route_count,
+                               ndi_bulk_op_error_mode_t mode,
+                               t_std_error *status_list);
+
+/**
+ * @brief Delete a list of routes (IPv4 or IPv6) from NPU Routing table
+ *
+ * See ndi_bulk_op_error_mode_t for the status_list contract.
+ *
+ * @param route_list - list of route entries
+ * @param route_count - number of entries in route_list
+ * @param mode - bulk error handling mode
+ * @param[out] status_list - per-entry status, same size as route_list
+ *
+ * @return STD_ERR_OK if all the entries are deleted successfully otherwise
+ *  the error code of the first failed entry is returned.
+ */
+t_std_error ndi_route_bulk_delete(ndi_route_t *route_list, size_t route_count,
+                                  ndi_bulk_op_error_mode_t mode,
+                                  t_std_error *status_list);
+
 /**
  * @brief Add a neighbor entry (IPv4 or IPv6) into NPU ARP table
  *
@@ -209,6 +244,48 @@ t_std_error ndi_route_next_hop_add (ndi_neighbor_t *p_nbr_entry, next_hop_id_t *
  */
 t_std_error ndi_route_next_hop_delete (npu_id_t npu_id, next_hop_id_t nh_handle);
 
+/**
+ * @brief Add a list of neighbor entries (IPv4 or IPv6) into NPU ARP table
+ *  and optionally create a Next Hop entry for each of them
+ *
+ * If nh_handle_list is not NULL, a next hop is created for every neighbor
+ * that is added successfully, as done by ndi_route_next_hop_add. An entry
+ * is reported as failed if either the neighbor or its next hop fails, in
+ * which case the neighbor is not left behind in the NPU.
+ * See ndi_bulk_op_error_mode_t for the status_list contract.
+ *
+ * @param nbr_list - list of neighbor entries
+ * @param nbr_count - number of entries in nbr_list
+ * @param mode - bulk error handling mode
+ * @param[out] nh_handle_list - next hop id per entry, NULL to skip next
+ *  hop creation
+ * @param[out] status_list - per-entry status, same size as nbr_list
+ *
+ * @return STD_ERR_OK if all the entries are programmed successfully otherwise
+ *  the error code of the first failed entry is returned.
+ */
+t_std_error ndi_route_neighbor_bulk_add (ndi_neighbor_t *nbr_list, size_t nbr_count,
+                                         ndi_bulk_op_error_mode_t mode,
+                                         next_hop_id_t *nh_handle_list,
+                                         t_std_error *status_list);
+
+/**
+ * @brief Delete a list of neighbor entries (IPv4 or IPv6) from NPU ARP table
+ *
+ * See ndi_bulk_op_error_mode_t for the status_list contract.
+ *
+ * @param nbr_list - list of neighbor entries
+ * @param nbr_count - number of entries in nbr_list
+ * @param mode - bulk error handling mode
+ * @param[out] status_list - per-entry status, same size as nbr_list
+ *
+ * @return STD_ERR_OK if all the entries are deleted successfully otherwise
+ *  the error code of the first failed entry is returned.
+ */
+t_std_error ndi_route_neighbor_bulk_delete (ndi_neighbor_t *nbr_list, size_t nbr_count,
+                                            ndi_bulk_op_error_mode_t mode,
+                                            t_std_error *status_list);
+
 
 /*
  *  NH Group header starts here
@@ -266,6 +343,40 @@ typedef struct ndi_nh_group_s {
     bool                    res_hash;        /* resilient hash */
 } ndi_nh_group_t;
 
+/*
+ * Nexthop Group member
+ */
+typedef struct ndi_nh_group_member_s {
+    next_hop_id_t           id;           /* Next hop handle */
+    uint32_t                weight;       /* Member weight, used for WECMP */
+} ndi_nh_group_member_t;
+
+/*
+ * List of Nexthop Group members, the member memory is owned by the caller
+ */
+typedef struct ndi_nh_group_member_list_s {
+    size_t                  count;        /* Number of members */
+    ndi_nh_group_member_t  *list;         /* Member list */
+} ndi_nh_group_member_list_t;
+
+/*
+ * @brief the variable size Nexthop Group data structure
+ *
+ * Same as ndi_nh_group_t except that the members are passed as a caller
+ * owned list, so the group size is not bounded by NDI_MAX_NH_ENTRIES_PER_GROUP.
+ */
+typedef struct ndi_nh_group_desc_s {
+    npu_id_t                npu_id;       /* NPU ID. */
+    ndi_route_group_nh_flags flags;       /* NH group flags */
+    ndi_route_group_nh_type group_type;   /* NH group type flags */
+    ndi_vrf_id_t            vrf_id;       /* VRF Id */
+    hal_ip_addr_t           prefix;       /* Prefix address */
+    uint32_t                mask_len;     /* IPv4/ipv6 subnet mask length*/
+    ndi_nh_group_member_list_t members;   /* List of nexthops */
+    next_hop_id_t           nh_group_handle; /* Nexthop group handle */
+    bool                    res_hash;        /* resilient hash */
+} ndi_nh_group_desc_t;
+
 
 /**
  * @brief Create a Next-Hop Group for ECMP groups
@@ -341,6 +452,802 @@ t_std_error ndi_route_add_next_hop_to_group (ndi_nh_group_t *p_nh_group_entry,
 t_std_error ndi_route_delete_next_hop_from_group (ndi_nh_group_t *p_nh_group_entry,
                                                     next_hop_id_t nh_group_handle);
 
+/**
+ * @brief Get the maximum number of members supported in a Next-Hop Group
+ *
+ * @param npu_id - NPU ID
+ * @param[out] max_members - maximum number of members per group
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_next_hop_group_max_members_get (npu_id_t npu_id,
+                                                      uint32_t *max_members);
+
+/**
+ * @brief Create a Next-Hop Group from a variable size member list
+ *
+ * @param p_nh_group_desc - NH Group descriptor
+ * @param nh_group_handle - Next Hop Group ID(OUT)
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_next_hop_group_desc_create (ndi_nh_group_desc_t *p_nh_group_desc,
+                                                  next_hop_id_t *nh_group_handle);
+
+/**
+ * @brief Set group attribute for a Next-Hop Group from a variable size
+ *  member list
+ *
+ * @param p_nh_group_desc - NH Group descriptor
+ * @param nh_group_handle - Next Hop Group ID
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_set_next_hop_group_desc_attribute (
+                        ndi_nh_group_desc_t *p_nh_group_desc,
+                        next_hop_id_t nh_group_handle);
+
+/**
+ * @brief Get group attribute for a Next-Hop Group into a variable size
+ *  member list
+ *
+ * On input members.count is the number of entries allocated in members.list,
+ * on return it is the number of members in the group. If the list is too
+ * small, no member is copied, members.count is set to the required size and
+ * an error is returned.
+ *
+ * @param p_nh_group_desc - NH Group descriptor
+ * @param nh_group_handle - Next Hop Group ID
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_get_next_hop_group_desc_attribute (
+                          ndi_nh_group_desc_t *p_nh_group_desc,
+                          next_hop_id_t nh_group_handle);
+
+/**
+ * @brief Add Nexthop(s) in a variable size member list to Next-Hop Group
+ *
+ * @param p_nh_group_desc - NH Group descriptor
+ * @param nh_group_handle - Next Hop Group ID
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_add_next_hop_list_to_group (ndi_nh_group_desc_t *p_nh_group_desc,
+                                                  next_hop_id_t nh_group_handle);
+
+/**
+ * @brief Delete Nexthop(s) in a variable size member list from Next-Hop Group
+ *
+ * @param p_nh_group_desc - NH Group descriptor
+ * @param nh_group_handle - Next Hop Group ID
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_delete_next_hop_list_from_group (ndi_nh_group_desc_t *p_nh_group_desc,
+                                                       next_hop_id_t nh_group_handle);
+
+/*
+ * Nexthop Group membership sync request
+ *
+ * Contains the desired final member set of a group and, on return,
+ * the number of member changes that were applied to reach it.
+ */
+typedef struct ndi_nh_group_sync_s {
+    next_hop_id_t              nh_group_handle; /* Nexthop group handle */
+    ndi_nh_group_member_list_t members;         /* Desired final member set */
+    uint32_t                   added;           /* Members added (OUT) */
+    uint32_t                   removed;         /* Members removed (OUT) */
+    uint32_t                   weight_changed;  /* Members with updated weight (OUT) */
+} ndi_nh_group_sync_t;
+
+/**
+ * @brief Sync the membership of a list of Next-Hop Groups
+ *
+ * For each group the current members are compared with the desired member
+ * set and only the members that are added, removed or have a different
+ * weight are programmed, members that are unchanged are not rewritten.
+ * Changes across all the groups are batched into as few NPU calls as possible.
+ * See ndi_bulk_op_error_mode_t for the status_list contract.
+ *
+ * @param npu_id - NPU ID
+ * @param sync_list - list of group sync requests
+ * @param sync_count - number of entries in sync_list
+ * @param mode - bulk error handling mode
+ * @param[out] status_list - per-group status, same size as sync_list
+ *
+ * @return STD_ERR_OK if all the groups are synced successfully otherwise
+ *  the error code of the first failed group is returned.
+ */
+t_std_error ndi_route_next_hop_group_bulk_sync (npu_id_t npu_id,
+                                                ndi_nh_group_sync_t *sync_list,
+                                                size_t sync_count,
+                                                ndi_bulk_op_error_mode_t mode,
+                                                t_std_error *status_list);
+
+
+/*
+ *  Path Group header starts here
+ *
+ *  A path group is an indirection object that points at a next hop or a
+ *  next hop group. Routes that are programmed with the path group handle
+ *  as nh_handle (NDI_ROUTE_L3_NEXT_HOP_ID) follow it, so repointing the
+ *  path group re-routes all of them with a single NPU write.
+ */
+
+/**
+ * @brief Create a Path Group
+ *
+ * @param npu_id - NPU ID
+ * @param nh_handle - Next hop or next hop group the path group points at
+ * @param[out] path_group_handle - Path Group ID, used as route nh_handle
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_path_group_create (npu_id_t npu_id, next_hop_id_t nh_handle,
+                                         next_hop_id_t *path_group_handle);
+
+/**
+ * @brief Delete a Path Group, it must not be referenced by any route
+ *
+ * @param npu_id - NPU ID
+ * @param path_group_handle - Path Group ID
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_path_group_delete (npu_id_t npu_id,
+                                         next_hop_id_t path_group_handle);
+
+/**
+ * @brief Atomically repoint a Path Group to a different next hop or
+ *  next hop group
+ *
+ * @param npu_id - NPU ID
+ * @param path_group_handle - Path Group ID
+ * @param nh_handle - New next hop or next hop group
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_path_group_set_next_hop (npu_id_t npu_id,
+                                               next_hop_id_t path_group_handle,
+                                               next_hop_id_t nh_handle);
+
+/**
+ * @brief Get the next hop or next hop group a Path Group points at
+ *
+ * @param npu_id - NPU ID
+ * @param path_group_handle - Path Group ID
+ * @param[out] nh_handle - Next hop or next hop group
+ * @param[out] route_ref_count - Number of routes referencing the path group
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_path_group_get_next_hop (npu_id_t npu_id,
+                                               next_hop_id_t path_group_handle,
+                                               next_hop_id_t *nh_handle,
+                                               uint32_t *route_ref_count);
+
+
+/*
+ *  Shadow FIB header starts here
+ *
+ *  NDI keeps an in-process copy of the routes programmed per VRF through
+ *  the route add/delete/set APIs, so programmed state can be queried
+ *  without reading back from the NPU.
+ */
+
+/*
+ * Shadow FIB usage statistics
+ */
+typedef struct ndi_route_fib_stats_s {
+    uint64_t                ipv4_route_count; /* IPv4 routes in the shadow FIB */
+    uint64_t                ipv6_route_count; /* IPv6 routes in the shadow FIB */
+    uint64_t                memory_bytes;     /* Memory used by the shadow FIB */
+} ndi_route_fib_stats_t;
+
+/**
+ * @brief Shadow FIB walk callback function type
+ *
+ * @param context - context passed to ndi_route_fib_walk
+ * @param route_entry - route entry from the shadow FIB
+ *
+ * @return true to continue the walk, false to stop it
+ */
+typedef bool (*ndi_route_fib_walk_fn) (void *context, const ndi_route_t *route_entry);
+
+/**
+ * @brief Longest prefix match lookup of an address in the shadow FIB
+ *
+ * @param npu_id - NPU ID
+ * @param vrf_id - VRF Id
+ * @param addr - IPv4 or IPv6 address to look up
+ * @param[out] route_entry - programmed route that matches the address
+ *
+ * @return STD_ERR_OK if a matching route is found otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_fib_lookup (npu_id_t npu_id, ndi_vrf_id_t vrf_id,
+                                  const hal_ip_addr_t *addr,
+                                  ndi_route_t *route_entry);
+
+/**
+ * @brief Exact match lookup of a route in the shadow FIB
+ *
+ * @param route_entry - caller fills npu_id, vrf_id, prefix and mask_len,
+ *  the rest of the entry is filled from the programmed route on return
+ *
+ * @return STD_ERR_OK if the route is found otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_fib_get (ndi_route_t *route_entry);
+
+/**
+ * @brief Walk the routes of a VRF in the shadow FIB in prefix order
+ *
+ * The callback must not add or delete routes.
+ *
+ * @param npu_id - NPU ID
+ * @param vrf_id - VRF Id
+ * @param af_index - HAL_INET4_FAMILY or HAL_INET6_FAMILY
+ * @param walk_fn - callback invoked for each route
+ * @param context - passed as is to walk_fn
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_fib_walk (npu_id_t npu_id, ndi_vrf_id_t vrf_id,
+                                uint32_t af_index,
+                                ndi_route_fib_walk_fn walk_fn, void *context);
+
+/**
+ * @brief Get the shadow FIB usage statistics of a VRF
+ *
+ * @param npu_id - NPU ID
+ * @param vrf_id - VRF Id
+ * @param[out] stats - shadow FIB statistics
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_fib_get_stats (npu_id_t npu_id, ndi_vrf_id_t vrf_id,
+                                     ndi_route_fib_stats_t *stats);
+
+
+/*
+ *  Async route programming header starts here
+ *
+ *  Operations are queued without blocking the caller and programmed by a
+ *  dedicated NDI thread, results are reported through the registered
+ *  completion callback.
+ */
+
+/*
+ * Async operation type
+ */
+typedef enum {
+    NDI_ROUTE_ASYNC_OP_ROUTE_ADD = 1,      /* ndi_route_add */
+    NDI_ROUTE_ASYNC_OP_ROUTE_DELETE,       /* ndi_route_delete */
+    NDI_ROUTE_ASYNC_OP_ROUTE_SET,          /* ndi_route_set_attribute */
+    NDI_ROUTE_ASYNC_OP_NEIGHBOR_ADD,       /* ndi_route_neighbor_add */
+    NDI_ROUTE_ASYNC_OP_NEIGHBOR_DELETE,    /* ndi_route_neighbor_delete */
+    NDI_ROUTE_ASYNC_OP_NEXT_HOP_ADD,       /* ndi_route_next_hop_add */
+    NDI_ROUTE_ASYNC_OP_NEXT_HOP_DELETE,    /* ndi_route_next_hop_delete */
+    NDI_ROUTE_ASYNC_OP_INVALID
+} ndi_route_async_op_type_t;
+
+/*
+ * Async operation, the entry is copied into the queue on submit
+ */
+typedef struct ndi_route_async_op_s {
+    ndi_route_async_op_type_t op_type;    /* Operation type */
+    uint64_t                cookie;       /* Caller context, returned in the result */
+    union {
+        ndi_route_t         route;        /* Route operations */
+        ndi_neighbor_t      neighbor;     /* Neighbor and next hop add operations */
+        struct {
+            npu_id_t        npu_id;
+            next_hop_id_t   nh_handle;
+        } next_hop;                       /* Next hop delete operation */
+    } data;
+} ndi_route_async_op_t;
+
+/*
+ * Async operation result
+ */
+typedef struct ndi_route_async_result_s {
+    ndi_route_async_op_type_t op_type;    /* Operation type */
+    uint64_t                cookie;       /* Cookie from the submitted operation */
+    t_std_error             rc;           /* Programming result */
+    bool                    coalesced;    /* Operation was cancelled or merged by a
+                                             later operation on the same entry and
+                                             was not programmed on its own */
+    next_hop_id_t           nh_handle;    /* Next hop handle for NEXT_HOP_ADD */
+} ndi_route_async_result_t;
+
+/*
+ * Async queue statistics
+ */
+typedef struct ndi_route_async_stats_s {
+    uint64_t                submitted;    /* Operations accepted into the queue */
+    uint64_t                completed;    /* Operations reported as completed */
+    uint64_t                coalesced;    /* Operations absorbed by coalescing */
+    uint64_t                rejected;     /* Operations rejected on a full queue */
+    uint64_t                queue_depth;  /* Operations currently queued */
+    uint64_t                high_water_mark; /* Maximum queue depth seen */
+} ndi_route_async_stats_t;
+
+/**
+ * @brief   Async route operation completion callback function type
+ *
+ * Invoked from the NDI programming thread with the results of one or more
+ * operations in submission order.
+ *
+ * @param   result_list - list of operation results
+ * @param   result_count - number of entries in result_list
+ * @return  None
+ */
+typedef void (*ndi_route_async_completion_fn) (const ndi_route_async_result_t *result_list,
+                                               size_t result_count);
+
+/**
+ * @brief Register the callback function for async operation completion
+ *
+ * @param reg_fn - Callback function for operation completion
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_async_completion_register(ndi_route_async_completion_fn reg_fn);
+
+/**
+ * @brief Submit a list of route, neighbor and next hop operations
+ *
+ * Operations are queued and return without waiting for NPU programming.
+ * Operations on the same entry are programmed in submission order, route
+ * operations still in the queue may be coalesced as described for
+ * ndi_route_coalesce_cfg_t.
+ * Either all or none of the operations in the list are queued.
+ *
+ * A synchronous or bulk call on an entry with operations still queued or
+ * held, e.g. ndi_route_add or ndi_route_delete on the same (vrf_id, prefix,
+ * mask_len), first programs those operations without waiting for the hold
+ * window and then applies the call, so it always takes effect after them.
+ *
+ * @param op_list - list of operations
+ * @param op_count - number of entries in op_list
+ *
+ * @return STD_ERR_OK if the operations are queued otherwise a different
+ *  error code is returned, e.g. when the queue is full or no completion
+ *  callback is registered.
+ */
+t_std_error ndi_route_async_submit(const ndi_route_async_op_t *op_list, size_t op_count);
+
+/**
+ * @brief Wait until all the operations submitted before this call are completed
+ *
+ * @param timeout_ms - maximum time to wait in milliseconds
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_async_flush(uint32_t timeout_ms);
+
+/**
+ * @brief Get the async queue statistics
+ *
+ * @param[out] stats - async queue statistics
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_async_stats_get(ndi_route_async_stats_t *stats);
+
+/*
+ * Route coalescing configuration
+ *
+ * Route operations submitted through ndi_route_async_submit are held for
+ * up to hold_window_ms, keyed on (vrf_id, prefix, mask_len), and only the
+ * net effect of the held operations is programmed. Operations are only
+ * coalesced when the result is the same as programming them in order,
+ * which depends on whether the prefix is in the shadow FIB (programmed)
+ * when the first held operation is coalesced:
+ *
+ *  sequence        prefix programmed   net effect
+ *  add + set       no                  single add with the set attributes
+ *  add + delete    no                  nothing is programmed
+ *  set + set       yes                 single set with both attributes
+ *  set + delete    yes                 single delete
+ *  delete + add    yes                 single in-place update to the
+ *                                      attributes of the add
+ *
+ * Longer sequences are reduced pairwise in submission order. Any other
+ * sequence, or a sequence whose prefix state does not match the table,
+ * is programmed operation by operation in submission order. Absorbed
+ * operations are reported with rc STD_ERR_OK and coalesced set.
+ *
+ * When coalescing is disabled every operation is programmed on its own in
+ * submission order, which gives the baseline convergence time.
+ */
+typedef struct ndi_route_coalesce_cfg_s {
+    bool                    enable;         /* Enable route coalescing */
+    uint32_t                hold_window_ms; /* Hold time, 0 to only coalesce operations
+                                               already queued together */
+    uint32_t                max_held;       /* Held routes above which the oldest
+                                               are programmed before their window expires */
+} ndi_route_coalesce_cfg_t;
+
+/*
+ * Route coalescing statistics
+ */
+typedef struct ndi_route_coalesce_stats_s {
+    uint64_t                ops_received;   /* Route operations received */
+    uint64_t                ops_programmed; /* Route operations programmed to NPU */
+    uint64_t                ops_absorbed;   /* Route operations absorbed */
+    uint64_t                add_delete_cancelled; /* Add + delete pairs cancelled out */
+    uint64_t                set_merged;     /* Set operations merged into a prior add/set */
+    uint64_t                window_forced;  /* Routes programmed early due to max_held */
+} ndi_route_coalesce_stats_t;
+
+/**
+ * @brief Set the route coalescing configuration
+ *
+ * @param cfg - coalescing configuration
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_coalesce_config_set(const ndi_route_coalesce_cfg_t *cfg);
+
+/**
+ * @brief Get the route coalescing configuration
+ *
+ * @param[out] cfg - coalescing configuration
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_coalesce_config_get(ndi_route_coalesce_cfg_t *cfg);
+
+/**
+ * @brief Get the route coalescing statistics
+ *
+ * @param[out] stats - coalescing statistics
+ * @param clear - clear the statistics after reading
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_coalesce_stats_get(ndi_route_coalesce_stats_t *stats, bool clear);
+
+
+/*
+ *  Route snapshot header starts here
+ *
+ *  The programmed next hop, neighbor, NH group and route state of a VRF can
+ *  be saved into a snapshot file and reconciled against the desired state
+ *  after a warm restart, so that only the difference is reprogrammed.
+ */
+
+/*
+ * Snapshot file layout
+ *
+ * All multi-byte fields are little-endian irrespective of the host byte
+ * order. The file starts with ndi_route_snapshot_hdr_t followed by one
+ * section per record type at the offset given in the header. Records are
+ * packed with explicit reserved fields, reserved fields are written as 0.
+ * A reader walks each section with the record_size stride, so records
+ * written by a later version that appended fields can still be read.
+ * Sections with a record_size smaller than the record known to the reader
+ * are rejected.
+ */
+
+/* First 4 bytes of the file are 'N' 'D' 'I' 'R', read as a little-endian uint32 */
+#define NDI_ROUTE_SNAPSHOT_MAGIC    0x5249444e
+#define NDI_ROUTE_SNAPSHOT_VERSION  1
+
+/*
+ * IP address in snapshot records
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_ip_s {
+    uint32_t    af_index;       /* HAL_INET4_FAMILY or HAL_INET6_FAMILY */
+    uint8_t     addr[16];       /* IPv4 address in the first 4 bytes, network order */
+} ndi_route_snapshot_ip_t;      /* 20 bytes */
+
+/*
+ * Location of a record section in the snapshot file
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_section_s {
+    uint64_t    offset;         /* File offset of the first record */
+    uint64_t    count;          /* Number of records */
+    uint32_t    record_size;    /* Size of each record in bytes */
+    uint32_t    reserved;
+} ndi_route_snapshot_section_t; /* 24 bytes */
+
+/*
+ * Route snapshot file header
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_hdr_s {
+    uint32_t    magic;          /* NDI_ROUTE_SNAPSHOT_MAGIC */
+    uint16_t    version;        /* NDI_ROUTE_SNAPSHOT_VERSION */
+    uint16_t    hdr_size;       /* sizeof (ndi_route_snapshot_hdr_t) */
+    uint32_t    npu_id;         /* NPU ID */
+    uint32_t    reserved;
+    uint64_t    vrf_id;         /* VRF Id */
+    ndi_route_snapshot_section_t next_hop;        /* ndi_route_snapshot_nh_rec_t */
+    ndi_route_snapshot_section_t neighbor;        /* ndi_route_snapshot_nbr_rec_t */
+    ndi_route_snapshot_section_t nh_group;        /* ndi_route_snapshot_nh_group_rec_t */
+    ndi_route_snapshot_section_t nh_group_member; /* ndi_route_snapshot_nh_member_rec_t */
+    ndi_route_snapshot_section_t path_group;      /* ndi_route_snapshot_path_group_rec_t */
+    ndi_route_snapshot_section_t route;           /* ndi_route_snapshot_route_rec_t */
+} ndi_route_snapshot_hdr_t;     /* 168 bytes */
+
+/*
+ * Next hop record
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_nh_rec_s {
+    uint64_t    nh_handle;      /* Next hop handle */
+    uint64_t    rif_id;         /* Router Interface Id */
+    ndi_route_snapshot_ip_t ip_addr; /* Next hop address */
+    uint32_t    reserved;
+} ndi_route_snapshot_nh_rec_t;  /* 40 bytes */
+
+/*
+ * Neighbor record
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_nbr_rec_s {
+    uint64_t    rif_id;         /* Router Interface Id */
+    ndi_route_snapshot_ip_t ip_addr; /* Neighbor address */
+    uint32_t    state;
+    uint32_t    action;         /* ndi_route_action */
+    uint32_t    port_tgid;      /* Port/Trunk group packet is switched to */
+    uint8_t     neighbor_mac[6];
+    uint16_t    vlan_id;
+} ndi_route_snapshot_nbr_rec_t; /* 48 bytes */
+
+/*
+ * NH group record
+ *
+ * NH groups have a variable number of members, so the members of all groups
+ * are stored in the nh_group_member section and each group record refers to
+ * member_count consecutive member records starting at first_member.
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_nh_group_rec_s {
+    uint64_t    nh_group_handle; /* Nexthop group handle */
+    uint64_t    first_member;   /* Index of the first member record */
+    uint32_t    member_count;   /* Number of member records */
+    uint32_t    group_type;     /* ndi_route_group_nh_type */
+    uint32_t    flags;          /* ndi_route_group_nh_flags */
+    uint8_t     res_hash;       /* resilient hash */
+    uint8_t     reserved[3];
+} ndi_route_snapshot_nh_group_rec_t; /* 32 bytes */
+
+/*
+ * NH group member record
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_nh_member_rec_s {
+    uint64_t    nh_handle;      /* Next hop handle */
+    uint32_t    weight;         /* Member weight */
+    uint32_t    reserved;
+} ndi_route_snapshot_nh_member_rec_t; /* 16 bytes */
+
+/*
+ * Path Group record
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_path_group_rec_s {
+    uint64_t    path_group_handle; /* Path Group ID */
+    uint64_t    nh_handle;      /* Next hop or NH group the Path Group points at */
+} ndi_route_snapshot_path_group_rec_t; /* 16 bytes */
+
+/*
+ * Route record
+ */
+typedef struct __attribute__((packed)) ndi_route_snapshot_route_rec_s {
+    uint64_t    nh_handle;      /* Next hop, NH group or Path Group handle */
+    uint64_t    rif_id;         /* Router Interface Id */
+    ndi_route_snapshot_ip_t prefix; /* Prefix address */
+    uint32_t    mask_len;       /* IPv4/ipv6 subnet mask length */
+    uint32_t    flags;          /* ndi_route_flags */
+    uint32_t    action;         /* ndi_route_action */
+    int32_t     priority;       /* Priority (COS) */
+    uint32_t    tunnel_option;  /* Tunnel option value */
+    uint32_t    mpls_label;     /* MPLS label */
+    int32_t     lookup_class;   /* Classification class ID */
+} ndi_route_snapshot_route_rec_t; /* 64 bytes */
+
+/*
+ * Route snapshot reconcile statistics
+ */
+typedef struct ndi_route_reconcile_stats_s {
+    uint64_t                next_hops_added;    /* Next hops only in desired state */
+    uint64_t                next_hops_deleted;  /* Next hops only in snapshot */
+    uint64_t                next_hops_adopted;  /* Next hops not reprogrammed */
+    uint64_t                neighbors_added;
+    uint64_t                neighbors_deleted;
+    uint64_t                neighbors_updated;
+    uint64_t                neighbors_adopted;
+    uint64_t                nh_groups_added;
+    uint64_t                nh_groups_deleted;
+    uint64_t                nh_groups_updated;
+    uint64_t                nh_groups_adopted;
+    uint64_t                path_groups_added;
+    uint64_t                path_groups_deleted;
+    uint64_t                path_groups_adopted;
+    uint64_t                routes_added;       /* Routes only in desired state */
+    uint64_t                routes_deleted;     /* Routes only in snapshot */
+    uint64_t                routes_updated;     /* Routes with changed attributes */
+    uint64_t                routes_adopted;     /* Routes not reprogrammed */
+} ndi_route_reconcile_stats_t;
+
+/* Opaque reconcile session of a snapshot file */
+typedef struct ndi_route_snapshot_s ndi_route_snapshot_t;
+
+/**
+ * @brief Save the programmed route state of a VRF into a snapshot file
+ *
+ * @param npu_id - NPU ID
+ * @param vrf_id - VRF Id
+ * @param file_path - snapshot file path
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_save (npu_id_t npu_id, ndi_vrf_id_t vrf_id,
+                                     const char *file_path);
+
+/*
+ * Reconcile after a warm restart
+ *
+ * NAS does not know the handles of the objects that survived the restart,
+ * so reconcile is done in dependency order within a session:
+ *  1. ndi_route_snapshot_open
+ *  2. ndi_route_snapshot_reconcile_next_hops - returns the next hop handles
+ *  3. ndi_route_snapshot_reconcile_nh_groups - members refer to the handles
+ *     from step 2, returns the NH group handles
+ *  4. ndi_route_snapshot_reconcile_path_groups - targets refer to the
+ *     handles from steps 2 and 3, returns the Path Group handles
+ *  5. ndi_route_snapshot_reconcile_neighbors and
+ *     ndi_route_snapshot_reconcile_routes - routes refer to the handles from
+ *     steps 2 to 4
+ *  6. ndi_route_snapshot_close - deletes the snapshot entries that were not
+ *     adopted, routes first, then Path Groups, NH groups and next hops
+ * A desired entry that matches a snapshot entry is adopted and its handle is
+ * written back into the desired entry without reprogramming it. Each step
+ * may be called more than once to pass the desired state in chunks.
+ */
+
+/**
+ * @brief Open a snapshot file for reconcile
+ *
+ * Snapshots with an unknown magic, version or a truncated section are
+ * rejected.
+ *
+ * @param file_path - snapshot file path
+ * @param[out] snapshot - reconcile session
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_open (const char *file_path,
+                                     ndi_route_snapshot_t **snapshot);
+
+/**
+ * @brief Reconcile the desired next hops with the snapshot
+ *
+ * Next hops are matched on the VRF, RIF and next hop address.
+ *
+ * @param snapshot - reconcile session
+ * @param nh_list - desired next hops
+ * @param nh_count - number of entries in nh_list
+ * @param[out] nh_handle_list - adopted or newly created next hop handle of
+ *  each entry in nh_list
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_reconcile_next_hops (ndi_route_snapshot_t *snapshot,
+                                                    const ndi_neighbor_t *nh_list,
+                                                    size_t nh_count,
+                                                    next_hop_id_t *nh_handle_list);
+
+/**
+ * @brief Reconcile the desired NH groups with the snapshot
+ *
+ * NH groups are matched on the group type and member set. A matched group
+ * with different member weights or resilient hash is updated in place.
+ *
+ * @param snapshot - reconcile session
+ * @param nh_group_list - desired NH groups, nh_group_handle of each entry is
+ *  written with the adopted or newly created handle
+ * @param nh_group_count - number of entries in nh_group_list
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_reconcile_nh_groups (ndi_route_snapshot_t *snapshot,
+                                                    ndi_nh_group_desc_t *nh_group_list,
+                                                    size_t nh_group_count);
+
+/**
+ * @brief Reconcile the desired Path Groups with the snapshot
+ *
+ * A desired Path Group adopts a snapshot Path Group that points at the same
+ * next hop or NH group and was not adopted yet, otherwise a new Path Group
+ * is created.
+ *
+ * @param snapshot - reconcile session
+ * @param nh_handle_list - next hop or NH group each desired Path Group
+ *  points at
+ * @param path_group_count - number of entries in nh_handle_list
+ * @param[out] path_group_handle_list - adopted or newly created Path Group
+ *  handle of each entry in nh_handle_list
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_reconcile_path_groups (ndi_route_snapshot_t *snapshot,
+                                                      const next_hop_id_t *nh_handle_list,
+                                                      size_t path_group_count,
+                                                      next_hop_id_t *path_group_handle_list);
+
+/**
+ * @brief Reconcile the desired neighbors with the snapshot
+ *
+ * Neighbors are matched on the RIF and neighbor address, a matched neighbor
+ * with a different MAC, port or action is updated in place.
+ *
+ * @param snapshot - reconcile session
+ * @param neighbor_list - desired neighbors
+ * @param neighbor_count - number of entries in neighbor_list
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_reconcile_neighbors (ndi_route_snapshot_t *snapshot,
+                                                    const ndi_neighbor_t *neighbor_list,
+                                                    size_t neighbor_count);
+
+/**
+ * @brief Reconcile the desired routes with the snapshot
+ *
+ * Routes are matched on the prefix and mask length, a matched route with a
+ * different next hop handle, RIF, action, priority, tunnel option, MPLS
+ * label or lookup class is updated in place.
+ *
+ * @param snapshot - reconcile session
+ * @param route_list - desired routes
+ * @param route_count - number of entries in route_list
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_reconcile_routes (ndi_route_snapshot_t *snapshot,
+                                                 const ndi_route_t *route_list,
+                                                 size_t route_count);
+
+/**
+ * @brief Close a reconcile session
+ *
+ * @param snapshot - reconcile session, freed on return
+ * @param delete_stale - delete the snapshot entries that were not adopted
+ * @param[out] stats - reconcile statistics, may be NULL
+ *
+ * @return STD_ERR_OK if operation is successful otherwise a different
+ *  error code is returned.
+ */
+t_std_error ndi_route_snapshot_close (ndi_route_snapshot_t *snapshot,
+                                      bool delete_stale,
+                                      ndi_route_reconcile_stats_t *stats);
+
 /**
  *  \}
  */